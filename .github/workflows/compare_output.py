@@ -0,0 +1,97 @@
+#!/bin/env python
+
+"""Compare a test's output to a stored benchmark, allowing a tolerance
+on the numbers.
+
+Lines are compared token by token.  Tokens that are not numbers must
+agree exactly; numbers a and b must satisfy
+
+    |a - b| <= rtol * max(|a|, |b|) + atol
+
+Lines matching any --ignore regex (in either file) are skipped, in the
+same way as diff -I.
+
+This is meant for benchmarks whose values depend on the integrator's
+step-size history, which can shift at the level of the integration
+tolerance when an input table is regenerated or the compiler changes.
+"""
+
+import argparse
+import re
+import sys
+
+
+def read_lines(filename, ignore):
+    with open(filename) as f:
+        lines = [line.rstrip("\n") for line in f]
+    return [line for line in lines
+            if line.strip() and not any(r.search(line) for r in ignore)]
+
+
+def to_float(token):
+    try:
+        return float(token)
+    except ValueError:
+        return None
+
+
+def compare(test_lines, ref_lines, rtol, atol):
+
+    nerr = 0
+
+    if len(test_lines) != len(ref_lines):
+        print(f"number of lines differ: {len(test_lines)} vs {len(ref_lines)}")
+        return 1
+
+    for n, (tl, rl) in enumerate(zip(test_lines, ref_lines)):
+        tt = tl.split()
+        rt = rl.split()
+
+        bad = len(tt) != len(rt)
+
+        if not bad:
+            for a, b in zip(tt, rt):
+                fa = to_float(a)
+                fb = to_float(b)
+                if fa is None or fb is None:
+                    if a != b:
+                        bad = True
+                elif abs(fa - fb) > rtol * max(abs(fa), abs(fb)) + atol:
+                    bad = True
+
+        if bad:
+            print(f"line {n+1}:")
+            print(f"< {tl}")
+            print(f"> {rl}")
+            nerr += 1
+
+    return nerr
+
+
+def main():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--rtol", type=float, default=1.e-2,
+                        help="relative tolerance on numbers")
+    parser.add_argument("--atol", type=float, default=1.e-12,
+                        help="absolute tolerance on numbers")
+    parser.add_argument("-I", "--ignore", action="append", default=[],
+                        help="regex of lines to skip (may be repeated)")
+    parser.add_argument("test", help="output of the test")
+    parser.add_argument("benchmark", help="stored benchmark output")
+
+    args = parser.parse_args()
+
+    ignore = [re.compile(r) for r in args.ignore]
+
+    nerr = compare(read_lines(args.test, ignore),
+                   read_lines(args.benchmark, ignore),
+                   args.rtol, args.atol)
+
+    if nerr > 0:
+        print(f"{nerr} line(s) differ by more than rtol = {args.rtol}, atol = {args.atol}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -9,17 +9,21 @@ AMREX_GPU_MANAGED amrex::Real helmholtz::t[jmax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::ttol;
 AMREX_GPU_MANAGED amrex::Real helmholtz::dtol;
 
-// for the helmholtz free energy tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::f[jmax][imax][9];
-
-// for the pressure derivative with density tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::dpdf[jmax][imax][4];
-
-// for chemical potential tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::ef[jmax][imax][4];
-
-// for the number density tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::xf[jmax][imax][4];
+// the free energy, pressure derivative, chemical potential, and
+// number density tables, interleaved
+#ifdef AMREX_USE_GPU
+AMREX_GPU_MANAGED helmholtz::helm_point_t helmholtz::helm_table[jmax][imax];
+#else
+const helmholtz::helm_point_t (*helmholtz::helm_table)[imax] = nullptr;
+
+amrex::Vector<helmholtz::helm_table_t> helmholtz::helm_table_storage;
+binary_table::mapped_table_t helmholtz::helm_table_file;
+#endif
+
+#ifdef HELM_TABLE_SINGLE_PRECISION
+AMREX_GPU_MANAGED amrex::Real helmholtz::d_unscale[imax][max_d_power+1];
+AMREX_GPU_MANAGED amrex::Real helmholtz::t_unscale[jmax][max_t_power-min_t_power+1];
+#endif
 
 // for storing the differences
 AMREX_GPU_MANAGED amrex::Real helmholtz::dt_sav[jmax];
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+"""Report the accuracy of the helmholtz EOS with single precision tables.
+
+When Microphysics is built with HELM_TABLE_SINGLE_PRECISION=TRUE, the
+pressure derivative, chemical potential, and number density entries of
+the helmholtz table are stored as float (scaled by powers of the
+density and temperature at each table point, see actual_eos_data.H),
+while the free energy entries stay in double and the interpolation is
+still done in double precision.  This script mimics that: it reads
+helm_table.dat, makes a copy of the table rounded to single precision
+in the same way, and then evaluates the electron-
+positron part of the EOS (the only part that uses the table) with
+both tables over the same grid of density, temperature, and
+composition that unit_test/test_eos uses.  For each quantity it prints
+the maximum, RMS, and median relative difference and where the maximum
+occurs.
+
+Usage:
+
+    table_precision_report.py [--table helm_table.dat] [--n_cell 16]
+                              [--dens_min 10] [--dens_max 5.e9]
+                              [--temp_min 1.e6] [--temp_max 1.e10]
+                              [--metalicity_max 0.5]
+
+The defaults match unit_test/test_eos/input_eos.  Only the Python
+standard library is needed.
+"""
+
+import argparse
+import math
+import statistics
+import struct
+
+# table layout -- this needs to match actual_eos_data.H
+
+imax = 541
+jmax = 201
+
+tlo = 3.0
+thi = 13.0
+dlo = -12.0
+dhi = 15.0
+
+tstp = (thi - tlo) / (jmax - 1)
+dstp = (dhi - dlo) / (imax - 1)
+
+ifree = 0
+idpdf = 9
+ief = 13
+ixf = 17
+nhelm = 21
+
+# derivative orders of the table entries in d and t
+D_ORDER4 = [0, 0, 1, 1]
+T_ORDER4 = [0, 1, 0, 1]
+
+
+def table_powers(m):
+    """the powers of d and t that entry m (m >= idpdf, the entries
+    stored as float) is scaled by -- this needs to match
+    helm_table_powers() in actual_eos.H"""
+
+    if m < ief:
+        return D_ORDER4[m - idpdf] + 1, T_ORDER4[m - idpdf] - 4
+    if m < ixf:
+        return D_ORDER4[m - ief], T_ORDER4[m - ief]
+    return D_ORDER4[m - ixf], T_ORDER4[m - ixf] - 3
+
+
+def to_float(x):
+    """round to the nearest single precision value"""
+    return struct.unpack("f", struct.pack("f", x))[0]
+
+
+class HelmTable:
+    """the table data, stored the same way as in actual_eos_init()"""
+
+    def __init__(self, filename):
+
+        self.t = [10.0**(tlo + j * tstp) for j in range(jmax)]
+        self.d = [10.0**(dlo + i * dstp) for i in range(imax)]
+
+        self.data = [[[0.0] * nhelm for _ in range(imax)] for _ in range(jmax)]
+
+        with open(filename) as table:
+
+            # free energy: the file has f, fd, ft, fdd, ftt, fdt, fddt, fdtt, fddtt
+            for j in range(jmax):
+                for i in range(imax):
+                    v = [float(x) for x in table.readline().split()]
+                    entry = self.data[j][i]
+                    for col, m in enumerate([0, 3, 1, 4, 2, 5, 6, 7, 8]):
+                        entry[ifree + m] = v[col]
+
+            # pressure derivative, chemical potential, and number
+            # density: the file has value, d, t, dt
+            for start in (idpdf, ief, ixf):
+                for j in range(jmax):
+                    for i in range(imax):
+                        v = [float(x) for x in table.readline().split()]
+                        entry = self.data[j][i]
+                        for col, m in enumerate([0, 2, 1, 3]):
+                            entry[start + m] = v[col]
+
+        self.dt_sav = [self.t[j+1] - self.t[j] for j in range(jmax-1)]
+        self.dd_sav = [self.d[i+1] - self.d[i] for i in range(imax-1)]
+
+    def single_precision_copy(self):
+        """return a copy of the table with the entries rounded the way
+        the single precision table stores them"""
+
+        other = object.__new__(HelmTable)
+        other.t = self.t
+        other.d = self.d
+        other.dt_sav = self.dt_sav
+        other.dd_sav = self.dd_sav
+
+        powers = [table_powers(m) for m in range(idpdf, nhelm)]
+        other.data = []
+        for j in range(jmax):
+            rows = []
+            for i in range(imax):
+                # the free energy block is kept in double
+                entry = self.data[j][i][ifree:idpdf]
+                for m, value in enumerate(self.data[j][i][idpdf:]):
+                    dp, tp = powers[m]
+                    scale = self.d[i]**dp * self.t[j]**tp
+                    entry.append(to_float(value * scale) / scale)
+                rows.append(entry)
+            other.data.append(rows)
+
+        return other
+
+
+def psi0(z):
+    return z * z * z * (z * (-6.0 * z + 15.0) - 10.0) + 1.0
+
+
+def dpsi0(z):
+    return z * z * (z * (-30.0 * z + 60.0) - 30.0)
+
+
+def ddpsi0(z):
+    return z * (z * (-120.0 * z + 180.0) - 60.0)
+
+
+def psi1(z):
+    return z * (z * z * (z * (-3.0 * z + 8.0) - 6.0) + 1.0)
+
+
+def dpsi1(z):
+    return z * z * (z * (-15.0 * z + 32.0) - 18.0) + 1.0
+
+
+def ddpsi1(z):
+    return z * (z * (-60.0 * z + 96.0) - 36.0)
+
+
+def psi2(z):
+    return 0.5 * z * z * (z * (z * (-z + 3.0) - 3.0) + 1.0)
+
+
+def dpsi2(z):
+    return 0.5 * z * (z * (z * (-5.0 * z + 12.0) - 9.0) + 2.0)
+
+
+def ddpsi2(z):
+    return 0.5 * (z * (z * (-20.0 * z + 36.0) - 18.0) + 2.0)
+
+
+def xpsi0(z):
+    return z * z * (2.0 * z - 3.0) + 1.0
+
+
+def xdpsi0(z):
+    return z * (6.0 * z - 6.0)
+
+
+def xpsi1(z):
+    return z * (z * (z - 2.0) + 1.0)
+
+
+def xdpsi1(z):
+    return z * (3.0 * z - 4.0) + 1.0
+
+
+def electrons(table, rho, temp, ye):
+    """the electron-positron quantities from the table, following
+    apply_electrons() in actual_eos.H"""
+
+    din = ye * rho
+
+    jat = int((math.log10(temp) - tlo) / tstp) + 1
+    jat = min(max(jat, 1), jmax - 1) - 1
+    iat = int((math.log10(din) - dlo) / dstp) + 1
+    iat = min(max(iat, 1), imax - 1) - 1
+
+    dt = table.dt_sav[jat]
+    dd = table.dd_sav[iat]
+
+    xt = max((temp - table.t[jat]) / dt, 0.0)
+    xd = max((din - table.d[iat]) / dd, 0.0)
+    mxt = 1.0 - xt
+    mxd = 1.0 - xd
+
+    # quintic basis functions in t and d (value, first, second
+    # derivative at each end), and their derivatives
+    sit = [psi0(xt), psi1(xt) * dt, psi2(xt) * dt**2,
+           psi0(mxt), -psi1(mxt) * dt, psi2(mxt) * dt**2]
+    dsit = [dpsi0(xt) / dt, dpsi1(xt), dpsi2(xt) * dt,
+            -dpsi0(mxt) / dt, dpsi1(mxt), -dpsi2(mxt) * dt]
+    ddsit = [ddpsi0(xt) / dt**2, ddpsi1(xt) / dt, ddpsi2(xt),
+             ddpsi0(mxt) / dt**2, -ddpsi1(mxt) / dt, ddpsi2(mxt)]
+
+    sid = [psi0(xd), psi1(xd) * dd, psi2(xd) * dd**2,
+           psi0(mxd), -psi1(mxd) * dd, psi2(mxd) * dd**2]
+    dsid = [dpsi0(xd) / dd, dpsi1(xd), dpsi2(xd) * dd,
+            -dpsi0(mxd) / dd, dpsi1(mxd), -dpsi2(mxd) * dd]
+
+    corners = [(jat, iat), (jat, iat+1), (jat+1, iat), (jat+1, iat+1)]
+
+    def biquintic(wt, wd):
+        # the free energy and its derivatives at each corner, ordered
+        # as (t order, d order)
+        total = 0.0
+        for jc, ic in corners:
+            entry = table.data[jc][ic]
+            # which of the basis functions go with this corner
+            toff = 0 if jc == jat else 3
+            doff = 0 if ic == iat else 3
+            fvals = {(0, 0): entry[0], (1, 0): entry[1], (2, 0): entry[2],
+                     (0, 1): entry[3], (0, 2): entry[4], (1, 1): entry[5],
+                     (1, 2): entry[6], (2, 1): entry[7], (2, 2): entry[8]}
+            for (to, do), f in fvals.items():
+                total += f * wt[toff + to] * wd[doff + do]
+        return total
+
+    free = biquintic(sit, sid)
+    df_d = biquintic(sit, dsid)
+    df_t = biquintic(dsit, sid)
+    df_dt = biquintic(dsit, dsid)
+    df_tt = biquintic(ddsit, sid)
+
+    # cubic basis functions for the other tables
+    cit = [xpsi0(xt), xpsi1(xt) * dt, xpsi0(mxt), -xpsi1(mxt) * dt]
+    cid = [xpsi0(xd), xpsi1(xd) * dd, xpsi0(mxd), -xpsi1(mxd) * dd]
+
+    def bicubic(start):
+        total = 0.0
+        for jc, ic in corners:
+            entry = table.data[jc][ic]
+            toff = 0 if jc == jat else 2
+            doff = 0 if ic == iat else 2
+            total += (entry[start] * cit[toff] * cid[doff] +
+                      entry[start+1] * cit[toff+1] * cid[doff] +
+                      entry[start+2] * cit[toff] * cid[doff+1] +
+                      entry[start+3] * cit[toff+1] * cid[doff+1])
+        return total
+
+    dpepdd = max(ye * bicubic(idpdf), 0.0)
+    eta = bicubic(ief)
+    xne = bicubic(ixf)
+
+    sele = -df_t * ye
+
+    return {"free energy": free,
+            "pele": din * din * df_d,
+            "dpepdt": din * din * df_dt,
+            "dpepdd": dpepdd,
+            "sele": sele,
+            "dsepdt": -df_tt * ye,
+            "eele": ye * free + temp * sele,
+            "deepdt": -temp * df_tt * ye,
+            "eta": eta,
+            "xne": xne}
+
+
+def main():
+
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--table", default="helm_table.dat")
+    parser.add_argument("--n_cell", type=int, default=16)
+    parser.add_argument("--dens_min", type=float, default=10.0)
+    parser.add_argument("--dens_max", type=float, default=5.e9)
+    parser.add_argument("--temp_min", type=float, default=1.e6)
+    parser.add_argument("--temp_max", type=float, default=1.e10)
+    parser.add_argument("--metalicity_max", type=float, default=0.5)
+    args = parser.parse_args()
+
+    table = HelmTable(args.table)
+    table_sp = table.single_precision_copy()
+
+    n = args.n_cell
+    dlogrho = (math.log10(args.dens_max) - math.log10(args.dens_min)) / (n - 1)
+    dlogT = (math.log10(args.temp_max) - math.log10(args.temp_min)) / (n - 1)
+    dmetal = args.metalicity_max / (n - 1)
+
+    errors = {}
+
+    for k in range(n):
+        # test_eos uses X(H) = 0.75 - Z/2, X(He) = 0.25 - Z/2, with
+        # the metals split evenly; we take Z/A = 1/2 for the metals
+        metalicity = k * dmetal
+        ye = (0.75 - 0.5 * metalicity) + 0.5 * (0.25 - 0.5 * metalicity) + 0.5 * metalicity
+
+        for j in range(n):
+            temp = 10.0**(math.log10(args.temp_min) + j * dlogT)
+            for i in range(n):
+                rho = 10.0**(math.log10(args.dens_min) + i * dlogrho)
+
+                ref = electrons(table, rho, temp, ye)
+                new = electrons(table_sp, rho, temp, ye)
+
+                for name, value in ref.items():
+                    if value == 0.0:
+                        continue
+                    rel = abs(new[name] - value) / abs(value)
+                    errors.setdefault(name, []).append((rel, rho, temp, ye))
+
+    print(f"relative difference between single and double precision tables "
+          f"({n}**3 points, {args.dens_min:g} <= rho <= {args.dens_max:g}, "
+          f"{args.temp_min:g} <= T <= {args.temp_max:g})\n")
+
+    print(f"{'quantity':>12}  {'max':>10}  {'RMS':>10}  {'median':>10}  "
+          f"{'rho (max)':>10}  {'T (max)':>10}  {'Ye (max)':>8}")
+    for name, values in errors.items():
+        worst = max(values)
+        rms = math.sqrt(statistics.fmean(v[0]**2 for v in values))
+        median = statistics.median(v[0] for v in values)
+        print(f"{name:>12}  {worst[0]:10.3e}  {rms:10.3e}  {median:10.3e}  "
+              f"{worst[1]:10.3e}  {worst[2]:10.3e}  {worst[3]:8.4f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -15,6 +15,12 @@
 #ifdef NSE_TABLE
 #include <nse_table.H>
 #endif
+#ifdef SCREENING
+#include <screen.H>
+#endif
+#ifdef NEUTRINO_TABLE
+#include <sneut5.H>
+#endif
 
 void network_init()
 {
@@ -27,13 +33,26 @@ nonaka_init();
     actual_network_init();
     RHS::rhs_init();
 #else
+    if (integrator_rp::jacobian == 3) {
+        amrex::Error("integrator.jacobian = 3 is only supported for networks that use rhs.H");
+    }
+
     actual_network_init();
     actual_rhs_init();
 #endif
 
+#ifdef SCREENING
+    screening_init();
+#endif
+
 #ifdef NSE_TABLE
     // read in the NSE table (if there is one)
     init_nse();
 #endif
 #endif
+
+#ifdef NEUTRINO_TABLE
+    // tabulate the pair, plasma, and photoneutrino losses
+    sneut5_table::init();
+#endif
 }
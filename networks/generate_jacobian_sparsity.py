@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Generate jacobian_sparsity.H for pynucastro networks.
+
+The structurally nonzero species-species Jacobian terms are read from
+the jac.set() calls in the jac_nuc() function of the network's
+actual_rhs.H.  We also compute a fill-reducing (minimum degree)
+elimination order for the species, so that the sparse LU in
+util/sparse_linpack.H produces as little fill-in as possible.
+
+Usage:
+
+    generate_jacobian_sparsity.py [network_dir ...]
+
+With no arguments, every network directory below the current one that
+contains both a pynucastro.net and an actual_rhs.H with a jac_nuc()
+function is processed.
+"""
+
+import re
+import sys
+from pathlib import Path
+
+HEADER = """\
+#ifndef JACOBIAN_SPARSITY_H
+#define JACOBIAN_SPARSITY_H
+
+// This file is generated by Microphysics/networks/generate_jacobian_sparsity.py
+// from the jac_nuc() function in actual_rhs.H -- do not edit it by hand.
+
+#include <network_properties.H>
+
+namespace jacobian_sparsity
+{{
+    // the structurally nonzero species-species terms of the Jacobian,
+    // as {{row, column}}
+
+    constexpr int num_terms = {num_terms};
+
+    constexpr int terms[num_terms][2] = {{
+{terms}
+    }};
+
+    // the order in which the species are eliminated in the LU
+    // factorization (minimum degree ordering)
+
+    constexpr int elimination_order[NumSpec] = {{
+{order}
+    }};
+}}
+
+#endif
+"""
+
+
+def read_species(net_file):
+    """return the names of the (non-extra) species, in network order"""
+
+    species = []
+    with open(net_file) as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line or line.startswith("__"):
+                continue
+            fields = line.split()
+            species.append(fields[1].capitalize())
+    return species
+
+
+def read_jacobian_terms(rhs_file):
+    """return the (row, column) pairs set in jac_nuc()"""
+
+    source = Path(rhs_file).read_text()
+    start = source.find("void jac_nuc(")
+    if start < 0:
+        return None
+    end = source.find("\n}\n", start)
+    return re.findall(r"jac\.set\((\w+),\s*(\w+),", source[start:end])
+
+
+def minimum_degree_order(species, terms):
+    """greedy minimum degree ordering on the symmetrized graph"""
+
+    adjacency = {s: set() for s in species}
+    for row, col in terms:
+        if row != col:
+            adjacency[row].add(col)
+            adjacency[col].add(row)
+
+    order = []
+    position = {s: n for n, s in enumerate(species)}
+    while adjacency:
+        node = min(adjacency, key=lambda s: (len(adjacency[s]), position[s]))
+        neighbors = adjacency.pop(node)
+        # eliminating node connects all of its neighbors
+        for other in neighbors:
+            adjacency[other] |= neighbors
+            adjacency[other].discard(other)
+            adjacency[other].discard(node)
+        order.append(node)
+
+    return order
+
+
+def generate(network_dir):
+    network_dir = Path(network_dir)
+
+    terms = read_jacobian_terms(network_dir / "actual_rhs.H")
+    if not terms:
+        return False
+
+    species = read_species(network_dir / "pynucastro.net")
+    order = minimum_degree_order(species, terms)
+
+    indent = " " * 8
+    term_lines = ",\n".join(f"{indent}{{Species::{r}, Species::{c}}}" for r, c in terms)
+    order_lines = ",\n".join(f"{indent}Species::{s}" for s in order)
+
+    with open(network_dir / "jacobian_sparsity.H", "w") as f:
+        f.write(HEADER.format(num_terms=len(terms), terms=term_lines, order=order_lines))
+
+    return True
+
+
+def main():
+    if len(sys.argv) > 1:
+        network_dirs = [Path(d) for d in sys.argv[1:]]
+    else:
+        network_dirs = sorted(p.parent for p in Path.cwd().glob("**/pynucastro.net")
+                              if not p.parent.is_symlink())
+
+    for network_dir in network_dirs:
+        if generate(network_dir):
+            print(f"wrote {network_dir / 'jacobian_sparsity.H'}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Generate rate_reactants.H for pynucastro networks.
+
+For each rate we find the reactant nuclei from the Y(...) factors
+multiplying screened_rates(k_...) in the rhs_nuc() function of the
+network's actual_rhs.H.  This is used with USE_LAZY_RATES=TRUE to
+skip evaluating rates whose reactants are not present.
+
+The rates that the approximate rates in reaclib_rates.H are built
+from are written with no reactants, so they are always evaluated.
+
+Usage:
+
+    generate_rate_reactants.py [network_dir ...]
+
+With no arguments, every network directory below the current one that
+contains both a pynucastro.net and an actual_rhs.H with a rhs_nuc()
+function is processed.
+"""
+
+import re
+import sys
+from pathlib import Path
+
+HEADER = """\
+#ifndef RATE_REACTANTS_H
+#define RATE_REACTANTS_H
+
+// This file is generated by Microphysics/networks/generate_rate_reactants.py
+// from the rhs_nuc() function in actual_rhs.H -- do not edit it by hand.
+
+#include <actual_network.H>
+
+namespace rate_reactants
+{{
+    // the reactant nuclei of each rate, with repeated nuclei listed
+    // once per appearance, padded with 0.  Rates without any
+    // reactants listed are always evaluated.
+
+    constexpr int max_reactants = {max_reactants};
+
+    constexpr int reactants[Rates::NumRates][max_reactants] = {{
+{reactants}
+    }};
+}}
+
+#endif
+"""
+
+TERM = re.compile(r"screened_rates\((k_\w+)\)((?:\*(?:Y\(\w+\)|amrex::Math::powi<\d+>\(Y\(\w+\)\)|amrex::Math::powi<\d+>\(state\.rho\)|state\.rho))*)")
+FACTOR = re.compile(r"Y\((\w+)\)|amrex::Math::powi<(\d+)>\(Y\((\w+)\)\)")
+
+
+def read_rates(network_file):
+    """return the rate names in the Rates:: enum, in order"""
+
+    source = Path(network_file).read_text()
+    start = source.find("enum NetworkRates")
+    end = source.find("}", start)
+    return re.findall(r"(k_\w+)\s*=", source[start:end])
+
+
+def read_reactants(rhs_file):
+    """return a dict of rate name -> list of reactant species"""
+
+    source = Path(rhs_file).read_text()
+    start = source.find("void rhs_nuc(")
+    if start < 0:
+        return None
+    end = source.find("\n}\n", start)
+
+    reactants = {}
+    for rate, factors in TERM.findall(source[start:end]):
+        species = []
+        for name, power, power_name in FACTOR.findall(factors):
+            if name:
+                species.append(name)
+            else:
+                species += [power_name] * int(power)
+        reactants.setdefault(rate, species)
+    return reactants
+
+
+def read_approx_dependencies(rates_file):
+    """return the set of rates used to build the approximate rates"""
+
+    source = Path(rates_file).read_text()
+    needed = set()
+    for match in re.finditer(r"void rate_\w+_approx\(const T& rate_eval", source):
+        end = source.find("\n}\n", match.start())
+        needed |= set(re.findall(r"screened_rates\((k_\w+)\)", source[match.start():end]))
+    return needed
+
+
+def generate(network_dir):
+    network_dir = Path(network_dir)
+
+    reactants = read_reactants(network_dir / "actual_rhs.H")
+    if not reactants:
+        return False
+
+    rates = read_rates(network_dir / "actual_network.H")
+    needed = read_approx_dependencies(network_dir / "reaclib_rates.H")
+
+    for rate in needed:
+        reactants.pop(rate, None)
+
+    max_reactants = max(len(r) for r in reactants.values())
+
+    indent = " " * 8
+    lines = []
+    for rate in rates:
+        species = [f"Species::{s}" for s in reactants.get(rate, [])]
+        species += ["0"] * (max_reactants - len(species))
+        lines.append(f"{indent}{{{', '.join(species)}}}, // {rate}")
+
+    with open(network_dir / "rate_reactants.H", "w") as f:
+        f.write(HEADER.format(max_reactants=max_reactants, reactants="\n".join(lines)))
+
+    return True
+
+
+def main():
+    if len(sys.argv) > 1:
+        network_dirs = [Path(d) for d in sys.argv[1:]]
+    else:
+        network_dirs = sorted(p.parent for p in Path.cwd().glob("**/pynucastro.net")
+                              if not p.parent.is_symlink())
+
+    for network_dir in network_dirs:
+        if generate(network_dir):
+            print(f"wrote {network_dir / 'rate_reactants.H'}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,7 @@
+#include <reaclib_rate_table_data.H>
+
+AMREX_GPU_MANAGED int reaclib_rate_table::nrates{};
+AMREX_GPU_MANAGED amrex::Array1D<int, 1, Rates::NumRates> reaclib_rate_table::rate_index;
+
+AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, Rates::NumRates, 0, reaclib_rate_table::npts-1> reaclib_rate_table::ln_rate;
+AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, Rates::NumRates, 0, reaclib_rate_table::npts-1> reaclib_rate_table::dln_rate_dlnT;
@@ -39,4 +39,14 @@ for net_file in sorted(cwd.glob("**/pynucastro.net")):
         print(f"error: python exited with status {result.returncode}")
     else:
         print("updated successfully")
+        # regenerate the compile-time Jacobian sparsity pattern
+        subprocess.run(
+            [sys.executable, cwd / "generate_jacobian_sparsity.py", network_dir],
+            check=False,
+        )
+        # and the reactants of each rate, for USE_LAZY_RATES
+        subprocess.run(
+            [sys.executable, cwd / "generate_rate_reactants.py", network_dir],
+            check=False,
+        )
     print()
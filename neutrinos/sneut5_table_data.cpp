@@ -0,0 +1,10 @@
+#include <sneut5_table_data.H>
+
+#ifdef NEUTRINO_TABLE
+namespace sneut5_table
+{
+    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 0, nfields-1, 0, npts-1> data;
+
+    AMREX_GPU_MANAGED bool initialized{false};
+}
+#endif
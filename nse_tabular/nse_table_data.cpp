@@ -3,13 +3,13 @@
 #ifdef NSE_TABLE
 namespace nse_table
 {
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> abartab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> beatab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dyedttab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dabardttab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dbeadttab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> enutab;
+#ifdef AMREX_USE_GPU
+    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 0, nfields-1, 1, npts> nse_data;
+#else
+    table_view_t nse_data;
 
-    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, NumSpec, 1, npts> massfractab;
+    amrex::Vector<amrex::Real> nse_table_storage;
+    binary_table::mapped_table_t nse_table_file;
+#endif
 }
 #endif
@@ -0,0 +1,6 @@
+#include <screen.H>
+
+#if SCREEN_METHOD == SCREEN_METHOD_chabrier1998_tabulated
+AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 0, scrn::chabrier1998_table::npts-1> scrn::chabrier1998_table::F;
+AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 0, scrn::chabrier1998_table::npts-1> scrn::chabrier1998_table::dFdlng;
+#endif
@@ -150,6 +150,27 @@ void main_main ()
     const int IOProc = ParallelDescriptor::IOProcessorNumber();
     ParallelDescriptor::ReduceRealMax(stop_time, IOProc);
 
+#if !defined(AMREX_USE_GPU) && !defined(NEUTRINO_TABLE)
+    // Check that the blocked sneut5_batch() agrees with sneut5()
+    Real max_batch_err = 0.0_rt;
+    for ( MFIter mfi(state); mfi.isValid(); ++mfi )
+    {
+      const Box& bx = mfi.validbox();
+
+      Array4<Real const> const sp = state.const_array(mfi);
+
+      max_batch_err = amrex::max(max_batch_err, neut_batch_test_C(bx, vars, sp));
+    }
+    ParallelDescriptor::ReduceRealMax(max_batch_err);
+
+    amrex::Print() << "maximum relative difference of sneut5_batch to sneut5 = "
+                   << max_batch_err << std::endl;
+
+    if (max_batch_err > 1.e-10_rt) {
+        amrex::Error("sneut5_batch does not agree with sneut5");
+    }
+#endif
+
 
     std::string name = "test_sneut5";
 
@@ -93,3 +93,109 @@ void neut_test_C(const Box& bx,
   });
 
 }
+
+#if !defined(AMREX_USE_GPU) && !defined(NEUTRINO_TABLE)
+
+// Evaluate the losses for all the zones of the box with sneut5_batch()
+// and compare to the sneut5() values stored by neut_test_C().  Returns
+// the largest relative difference in the loss and its derivatives.
+// (With USE_NEUTRINO_TABLE, sneut5() interpolates in the table, which
+// sneut5_batch() does not use, so there is nothing to compare.)
+
+Real neut_batch_test_C(const Box& bx, const plot_t& vars,
+                       Array4<Real const> const sp) {
+
+  const int npts = static_cast<int>(bx.numPts());
+
+  Vector<Real> temp(npts), dens(npts), abar(npts), zbar(npts);
+  Vector<Real> snu(npts), dsnudt(npts), dsnudd(npts), dsnuda(npts), dsnudz(npts);
+
+  const auto lo = amrex::lbound(bx);
+  const auto len = amrex::length(bx);
+
+  auto zone_index = [=] (const int n, int& i, int& j, int& k)
+  {
+      i = lo.x + n % len.x;
+      j = lo.y + (n / len.x) % len.y;
+      k = lo.z + n / (len.x * len.y);
+  };
+
+  for (int n = 0; n < npts; ++n) {
+    int i, j, k;
+    zone_index(n, i, j, k);
+
+    temp[n] = sp(i, j, k, vars.itemp);
+    dens[n] = sp(i, j, k, vars.irho);
+
+    // abar and zbar as in neut_test_C()
+
+    Real ainv = 0.0;
+    Real zsum = 0.0;
+    for (int m = 0; m < NumSpec; m++) {
+      ainv += sp(i, j, k, vars.ispec+m) / aion[m];
+      zsum += zion[m] * sp(i, j, k, vars.ispec+m) / aion[m];
+    }
+    abar[n] = 1.0_rt / ainv;
+    zbar[n] = zsum * abar[n];
+  }
+
+  sneut5_batch_t batch;
+  batch.npts = npts;
+  batch.temp = temp.data();
+  batch.den = dens.data();
+  batch.abar = abar.data();
+  batch.zbar = zbar.data();
+  batch.snu = snu.data();
+  batch.dsnudt = dsnudt.data();
+  batch.dsnudd = dsnudd.data();
+  batch.dsnuda = dsnuda.data();
+  batch.dsnudz = dsnudz.data();
+
+  constexpr int do_derivatives{1};
+
+  sneut5_batch<do_derivatives>(batch);
+
+  // the derivatives can pass through zero, so scale their
+  // differences by the size of the derivative over the whole box
+
+  auto max_abs = [&] (const int comp) {
+    Real m = 0.0_rt;
+    for (int n = 0; n < npts; ++n) {
+      int i, j, k;
+      zone_index(n, i, j, k);
+      m = amrex::max(m, std::abs(sp(i, j, k, comp)));
+    }
+    return m;
+  };
+
+  const Real scale[4] = {max_abs(vars.isneut), max_abs(vars.isneutdt),
+                         max_abs(vars.isneutda), max_abs(vars.isneutdz)};
+
+  Real max_err = 0.0_rt;
+
+  for (int n = 0; n < npts; ++n) {
+    int i, j, k;
+    zone_index(n, i, j, k);
+
+    const Real batch_vals[4] = {snu[n], dsnudt[n], dsnuda[n], dsnudz[n]};
+    const int comps[4] = {vars.isneut, vars.isneutdt, vars.isneutda, vars.isneutdz};
+
+    for (int q = 0; q < 4; ++q) {
+      const Real ref = sp(i, j, k, comps[q]);
+      const Real denom = amrex::max(std::abs(ref), 1.e-12_rt * scale[q]);
+      if (denom > 0.0_rt) {
+        max_err = amrex::max(max_err, std::abs(batch_vals[q] - ref) / denom);
+      }
+    }
+
+    // sneut5() does not compute the density derivative
+
+    max_err = amrex::max(max_err, std::abs(dsnudd[n]));
+  }
+
+  return max_err;
+
+}
+
+#endif
+
@@ -18,6 +18,10 @@ using namespace amrex;
 #include <variables.H>
 #include <unit_test.H>
 #include <react_util.H>
+#ifndef AMREX_USE_GPU
+#include <burn_scheduler.H>
+#include <burn_reorder.H>
+#endif
 
 int main (int argc, char* argv[])
 {
@@ -193,7 +197,195 @@ void main_main ()
 
     ValLocPair<int, burn_t> r;
 
-    {
+    bool scheduled{false};
+
+#ifndef AMREX_USE_GPU
+    if (unit_test_rp::use_burn_scheduler) {
+        BL_PROFILE("do_react_scheduled");
+
+        scheduled = true;
+
+        // there is no previous burn the first time through, so all
+        // zones are estimated to cost the same
+
+        integrator_n_rhs.setVal(0);
+
+        // each thread keeps the zone that took the most RHS calls
+
+#ifdef _OPENMP
+        const int nthreads = omp_get_max_threads();
+#else
+        const int nthreads = 1;
+#endif
+
+        for (int pass = 0; pass < amrex::max(unit_test_rp::n_burn_passes, 1); ++pass) {
+
+            // every pass burns the same zones, so only count the
+            // failures of the last one (this is host memory here)
+
+            *num_failed_d = 0;
+
+            Vector<ValLocPair<int, burn_t>> thread_max(nthreads, ValLocPair<int, burn_t>{-1, burn_t{}});
+
+            burn_scheduler::stats_t stats;
+
+            for (MFIter mfi(state, false); mfi.isValid(); ++mfi) {
+                const Box& bx = mfi.validbox();
+
+                auto const& s = state.array(mfi);
+                auto const& n_rhs = integrator_n_rhs.array(mfi);
+
+                stats += burn_scheduler::run(bx,
+                [&] (int i, int j, int k) -> int
+                {
+                    return n_rhs(i, j, k, 0);
+                },
+                [&] (int i, int j, int k)
+                {
+                    burn_t burn_state;
+                    bool success = do_react(i, j, k, s, burn_state, n_rhs, vars);
+
+                    if (!success) {
+                        Gpu::Atomic::Add(num_failed_d, 1);
+                    }
+
+#ifdef _OPENMP
+                    auto& tm = thread_max[omp_get_thread_num()];
+#else
+                    auto& tm = thread_max[0];
+#endif
+                    if (n_rhs(i, j, k, 0) > tm.value) {
+                        tm = ValLocPair<int, burn_t>{n_rhs(i, j, k, 0), burn_state};
+                    }
+                });
+            }
+
+            r = thread_max[0];
+            for (int t = 1; t < nthreads; ++t) {
+                if (thread_max[t].value > r.value) {
+                    r = thread_max[t];
+                }
+            }
+
+            amrex::Print() << "burn scheduler pass " << pass << ": wall time = " << stats.seconds
+                           << ", load imbalance (max / mean) = " << stats.imbalance() << std::endl;
+            for (int t = 0; t < static_cast<int>(stats.threads.size()); ++t) {
+                const auto& ts = stats.threads[t];
+                amrex::Print() << "  thread " << t << ": " << ts.seconds << " s, "
+                               << ts.zones << " zones, " << ts.chunks << " chunks ("
+                               << ts.stolen << " stolen)" << std::endl;
+            }
+        }
+    }
+
+    if (!scheduled && unit_test_rp::use_zone_reorder) {
+        BL_PROFILE("do_react_reordered");
+
+        scheduled = true;
+
+        // zones are handed out to the threads in chunks of this many
+        // consecutive zones of the sorted order
+
+        constexpr int chunk_size = 8;
+
+        const burn_reorder::binning_t binning;
+
+        // there is no previous burn the first time through, so the
+        // zones are only binned by their thermodynamic state
+
+        integrator_n_rhs.setVal(0);
+
+#ifdef _OPENMP
+        const int nthreads = omp_get_max_threads();
+#else
+        const int nthreads = 1;
+#endif
+
+        for (int pass = 0; pass < amrex::max(unit_test_rp::n_burn_passes, 1); ++pass) {
+
+            // every pass burns the same zones, so only count the
+            // failures of the last one (this is host memory here)
+
+            *num_failed_d = 0;
+
+            Vector<ValLocPair<int, burn_t>> thread_max(nthreads, ValLocPair<int, burn_t>{-1, burn_t{}});
+
+            const Real pass_start = ParallelDescriptor::second();
+
+            for (MFIter mfi(state, false); mfi.isValid(); ++mfi) {
+                const Box& bx = mfi.validbox();
+
+                auto const& s = state.array(mfi);
+                auto const& n_rhs = integrator_n_rhs.array(mfi);
+
+                const auto lo = amrex::lbound(bx);
+                const auto len = amrex::length(bx);
+                const int nzones = static_cast<int>(bx.numPts());
+
+                auto zone_index = [=] (const int n, int& i, int& j, int& k)
+                {
+                    i = lo.x + n % len.x;
+                    j = lo.y + (n / len.x) % len.y;
+                    k = lo.z + n / (len.x * len.y);
+                };
+
+                std::vector<int> bins(nzones);
+                for (int n = 0; n < nzones; ++n) {
+                    int i, j, k;
+                    zone_index(n, i, j, k);
+                    bins[n] = burn_reorder::zone_bin(binning, s(i, j, k, vars.irho), s(i, j, k, vars.itemp),
+                                                     n_rhs(i, j, k, 1));
+                }
+
+                const std::vector<int> order = burn_reorder::sort_zones(binning, bins);
+
+                const int nchunks = (nzones + chunk_size - 1) / chunk_size;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+                for (int c = 0; c < nchunks; ++c) {
+
+#ifdef _OPENMP
+                    auto& tm = thread_max[omp_get_thread_num()];
+#else
+                    auto& tm = thread_max[0];
+#endif
+
+                    const int n_end = amrex::min((c + 1) * chunk_size, nzones);
+
+                    for (int n = c * chunk_size; n < n_end; ++n) {
+                        int i, j, k;
+                        zone_index(order[n], i, j, k);
+
+                        burn_t burn_state;
+                        bool success = do_react(i, j, k, s, burn_state, n_rhs, vars);
+
+                        if (!success) {
+                            Gpu::Atomic::Add(num_failed_d, 1);
+                        }
+
+                        if (n_rhs(i, j, k, 0) > tm.value) {
+                            tm = ValLocPair<int, burn_t>{n_rhs(i, j, k, 0), burn_state};
+                        }
+                    }
+                }
+            }
+
+            r = thread_max[0];
+            for (int t = 1; t < nthreads; ++t) {
+                if (thread_max[t].value > r.value) {
+                    r = thread_max[t];
+                }
+            }
+
+            amrex::Print() << "burn reorder pass " << pass << ": wall time = "
+                           << ParallelDescriptor::second() - pass_start << std::endl;
+        }
+    }
+#endif
+
+    if (!scheduled) {
         BL_PROFILE("do_react");
 
         // Do the reactions
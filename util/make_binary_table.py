@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Convert the text helmholtz EOS and NSE tables to the binary format
+read by util/binary_table.H.
+
+The binary tables are loaded without any parsing, and on CPUs they are
+memory-mapped, so all of the ranks on a node share one copy.  The
+payload is stored in the order the code holds the table in memory, in
+the byte order of the machine this is run on (a table written with the
+other byte order is rejected at startup).
+
+Usage:
+
+    make_binary_table.py helm [--input helm_table.dat] [--output helm_table.bin]
+    make_binary_table.py nse --input nse_aprox19.tbl [--output nse_aprox19.bin]
+
+and then set eos.helm_table_name = helm_table.bin or
+network.nse_table_name = nse_aprox19.bin in the inputs file.  Only the
+Python standard library is needed.
+"""
+
+import argparse
+import array
+import pathlib
+import struct
+import sys
+import zlib
+
+# this needs to match binary_table.H
+
+MAGIC = b"MPHYSTBL"
+FORMAT_VERSION = 1
+ENDIAN_MARKER = 0x01020304
+MAX_DIMS = 4
+HEADER_FORMAT = f"=8sII32sII{MAX_DIMS}QQQII"
+DATA_ALIGNMENT = 4096
+
+# the layout version of each table's payload -- these need to match
+# binary_layout_version in actual_eos_data.H and nse_table_data.H
+HELM_LAYOUT_VERSION = 0
+NSE_LAYOUT_VERSION = 1
+
+# the helmholtz table layout -- this needs to match actual_eos_data.H
+
+IMAX = 541
+JMAX = 201
+IFREE = 0
+IDPDF = 9
+IEF = 13
+IXF = 17
+NHELM = 21
+
+
+def write_table(filename, name, layout_version, dims, payload):
+    """write the doubles in payload (an array.array) as the table name
+    with the given layout version and dimensions dims"""
+
+    num = 1
+    for n in dims:
+        num *= n
+    if len(payload) != num:
+        sys.exit(f"error: expected {num} values for {name}, but have {len(payload)}")
+
+    data = payload.tobytes()
+
+    header = struct.pack(HEADER_FORMAT,
+                         MAGIC, FORMAT_VERSION, ENDIAN_MARKER,
+                         name.encode(), payload.itemsize, len(dims),
+                         *(list(dims) + [0] * (MAX_DIMS - len(dims))),
+                         DATA_ALIGNMENT, len(data), zlib.crc32(data), layout_version)
+
+    with open(filename, "wb") as out:
+        out.write(header)
+        out.write(b"\0" * (DATA_ALIGNMENT - len(header)))
+        out.write(data)
+
+
+def read_values(table, nlines, ncols, filename):
+    """read nlines lines of ncols numbers each"""
+
+    rows = []
+    for _ in range(nlines):
+        v = [float(x) for x in table.readline().split()]
+        if len(v) != ncols:
+            sys.exit(f"error: {filename} is truncated or has a malformed line")
+        rows.append(v)
+    return rows
+
+
+def convert_helm(args):
+    """the helmholtz table, stored as in actual_eos_init(): the nhelm
+    values for each (t[j], d[i]) point together"""
+
+    payload = array.array("d", bytes(8 * JMAX * IMAX * NHELM))
+
+    with open(args.input) as table:
+
+        # free energy: the file has f, fd, ft, fdd, ftt, fdt, fddt, fdtt, fddtt
+        rows = read_values(table, JMAX * IMAX, 9, args.input)
+        for p, v in enumerate(rows):
+            for col, m in enumerate([0, 3, 1, 4, 2, 5, 6, 7, 8]):
+                payload[p * NHELM + IFREE + m] = v[col]
+
+        # pressure derivative, chemical potential, and number
+        # density: the file has value, d, t, dt
+        for start in (IDPDF, IEF, IXF):
+            rows = read_values(table, JMAX * IMAX, 4, args.input)
+            for p, v in enumerate(rows):
+                for col, m in enumerate([0, 2, 1, 3]):
+                    payload[p * NHELM + start + m] = v[col]
+
+    write_table(args.output or "helm_table.bin", "helmholtz", HELM_LAYOUT_VERSION,
+                [JMAX, IMAX, NHELM], payload)
+
+
+def convert_nse(args):
+    """the NSE table, stored as in init_nse(): for each point, abar,
+    bea, dyedt, dabardt, dbeadt, e_nu, and then the mass fractions"""
+
+    with open(args.input) as table:
+        # skip the header
+        for _ in range(4):
+            table.readline()
+        rows = [[float(x) for x in line.split()] for line in table if line.strip()]
+
+    if not rows:
+        sys.exit(f"error: {args.input} has no data")
+
+    nspec = len(rows[0]) - 9
+    if nspec < 1 or any(len(v) != nspec + 9 for v in rows):
+        sys.exit(f"error: {args.input} has a malformed line")
+
+    # the table is ordered with rho varying slowest and Ye fastest
+    ntemp = len({v[0] for v in rows})
+    nden = len({v[1] for v in rows})
+    nye = len({v[2] for v in rows})
+    if ntemp * nden * nye != len(rows):
+        sys.exit(f"error: {args.input} is not a complete rho, T, Ye grid")
+
+    payload = array.array("d")
+    for v in rows:
+        payload.extend(v[3:])
+
+    # the last dimension is the number of values at each point
+    output = args.output or str(pathlib.Path(args.input).with_suffix(".bin"))
+    write_table(output, "nse", NSE_LAYOUT_VERSION, [ntemp, nden, nye, 6 + nspec], payload)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="table", required=True)
+
+    helm = sub.add_parser("helm", help="convert the helmholtz EOS table")
+    helm.add_argument("--input", default="helm_table.dat")
+    helm.add_argument("--output", default=None)
+    helm.set_defaults(func=convert_helm)
+
+    nse = sub.add_parser("nse", help="convert an NSE table")
+    nse.add_argument("--input", required=True)
+    nse.add_argument("--output", default=None)
+    nse.set_defaults(func=convert_nse)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()